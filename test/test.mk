@@ -47,9 +47,16 @@ endif
 
 endef
 
+# Exit code 77 means the test can't run here, it says why on stderr.
+
+test_run = \
+	$(<) > $(@); res=$$?; \
+	if [ $$res = 77 ]; then echo "$(<): skipped" >&2; cp $(1) $(@); \
+	else [ $$res = 0 ] && diff -au $(1) $(@) >&2; fi
+
 %.res: % %.pat
-	@($(<) > $(@) && diff -au $(word 2,$(^)) $(@) >&2) || (rm $(@) && false)
+	@($(call test_run,$(word 2,$(^)))) || (rm $(@) && false)
 
 %.res: % %.pat.$(WORDSIZE)
-	@($(<) > $(@) && diff -au $(word 2,$(^)) $(@) >&2) || (rm $(@) && false)
+	@($(call test_run,$(word 2,$(^)))) || (rm $(@) && false)
 